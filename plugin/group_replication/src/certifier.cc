@@ -24,6 +24,7 @@
 #include <signal.h>
 #include <time.h>
 #include <map>
+#include <unordered_map>
 
 #include <mysql/components/services/log_builtins.h>
 #include "my_dbug.h"
@@ -1121,11 +1122,29 @@ void Certifier::garbage_collect() {
     precedes them), then "t" is stable and can be removed from
     the certification info.
   */
+  /*
+    All write set items of a transaction share the same snapshot version,
+    so remember the outcome per Gtid_set_ref instead of comparing the same
+    set against stable_gtid_set once per item. No Gtid_set_ref is created
+    while LOCK_certification_info is held, so a pointer seen here is never
+    reused by another snapshot version during this pass.
+  */
+  std::unordered_map<const Gtid_set_ref *, bool> stable_snapshot_versions;
   Certification_info::iterator it = certification_info.begin();
   stable_gtid_set_lock->wrlock();
   while (it != certification_info.end()) {
-    if (it->second->is_subset_not_equals(stable_gtid_set)) {
-      if (it->second->unlink() == 0) delete it->second;
+    Gtid_set_ref *snapshot_version = it->second;
+    auto cached = stable_snapshot_versions.find(snapshot_version);
+    bool is_stable;
+    if (cached != stable_snapshot_versions.end()) {
+      is_stable = cached->second;
+    } else {
+      is_stable = snapshot_version->is_subset_not_equals(stable_gtid_set);
+      stable_snapshot_versions.emplace(snapshot_version, is_stable);
+    }
+
+    if (is_stable) {
+      if (snapshot_version->unlink() == 0) delete snapshot_version;
       certification_info.erase(it++);
     } else
       ++it;
@@ -333,45 +333,65 @@ int ActiveTranx::clear_active_tranx_nodes(const char *log_file_name,
   return function_exit(kWho, 0);
 }
 
-int ReplSemiSyncMaster::reportReplyPacket(uint32 server_id, const uchar *packet,
-                                          ulong packet_len) {
-  const char *kWho = "ReplSemiSyncMaster::reportReplyPacket";
-  int result = -1;
-  char log_file_name[FN_REFLEN + 1];
-  my_off_t log_file_pos;
+int ReplSemiSyncMaster::parseReplyPacket(const uchar *packet,
+                                         ulong packet_len,
+                                         char *log_file_name,
+                                         my_off_t *log_file_pos) {
   ulong log_file_len = 0;
 
-  function_enter(kWho);
-
   if (unlikely(packet[REPLY_MAGIC_NUM_OFFSET] !=
                ReplSemiSyncMaster::kPacketMagicNum)) {
     LogErr(ERROR_LEVEL, ER_SEMISYNC_REPLY_MAGIC_NO_ERROR);
-    goto l_end;
+    return -1;
   }
 
   if (unlikely(packet_len < REPLY_BINLOG_NAME_OFFSET)) {
     LogErr(ERROR_LEVEL, ER_SEMISYNC_REPLY_PKT_LENGTH_TOO_SMALL);
-    goto l_end;
+    return -1;
   }
 
-  log_file_pos = uint8korr(packet + REPLY_BINLOG_POS_OFFSET);
   log_file_len = packet_len - REPLY_BINLOG_NAME_OFFSET;
   if (unlikely(log_file_len >= FN_REFLEN)) {
     LogErr(ERROR_LEVEL, ER_SEMISYNC_REPLY_BINLOG_FILE_TOO_LARGE);
-    goto l_end;
+    return -1;
   }
+
+  *log_file_pos = uint8korr(packet + REPLY_BINLOG_POS_OFFSET);
   strncpy(log_file_name, (const char *)packet + REPLY_BINLOG_NAME_OFFSET,
           log_file_len);
   log_file_name[log_file_len] = 0;
 
+  return 0;
+}
+
+int ReplSemiSyncMaster::reportReplyPacket(uint32 server_id, const uchar *packet,
+                                          ulong packet_len) {
+  const char *kWho = "ReplSemiSyncMaster::reportReplyPacket";
+  int result = -1;
+  char log_file_name[FN_REFLEN + 1];
+  my_off_t log_file_pos;
+
+  function_enter(kWho);
+
+  if (parseReplyPacket(packet, packet_len, log_file_name, &log_file_pos))
+    goto l_end;
+
+  reportReply(server_id, log_file_name, log_file_pos);
+
+l_end:
+  return function_exit(kWho, result);
+}
+
+void ReplSemiSyncMaster::reportReply(uint32 server_id,
+                                     const char *log_file_name,
+                                     my_off_t log_file_pos) {
+  const char *kWho = "ReplSemiSyncMaster::reportReply";
+
   if (trace_level_ & kTraceDetail)
     LogErr(INFORMATION_LEVEL, ER_SEMISYNC_SERVER_REPLY, kWho, log_file_name,
            (ulong)log_file_pos, server_id);
 
   handleAck(server_id, log_file_name, log_file_pos);
-
-l_end:
-  return function_exit(kWho, result);
 }
 
 /*******************************************************************************
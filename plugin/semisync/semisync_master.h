@@ -681,10 +681,28 @@ class ReplSemiSyncMaster : public ReplSemiSyncBase {
   /* Is the slave servered by the thread requested semi-sync */
   bool is_semi_sync_slave();
 
+  /* It parses a reply packet, logging an error if it is malformed.
+   *
+   * Input:
+   *  packet        - (IN)  the reply packet
+   *  packet_len    - (IN)  length of the packet
+   *  log_file_name - (OUT) binlog file name, at least FN_REFLEN + 1 bytes
+   *  log_file_pos  - (OUT) binlog file position
+   *
+   * Return:
+   *  0: success;  non-zero: the packet is malformed
+   */
+  static int parseReplyPacket(const uchar *packet, ulong packet_len,
+                              char *log_file_name, my_off_t *log_file_pos);
+
   /* It parses a reply packet and call reportReplyBinlog to handle it. */
   int reportReplyPacket(uint32 server_id, const uchar *packet,
                         ulong packet_len);
 
+  /* It handles a reply already parsed by parseReplyPacket(). */
+  void reportReply(uint32 server_id, const char *log_file_name,
+                   my_off_t log_file_pos);
+
   /* In semi-sync replication, reports up to which binlog position we have
    * received replies from the slave indicating that it already get the events
    * or that was skipped in the master.
@@ -243,6 +243,8 @@ static void init_net(NET *net, unsigned char *buff, unsigned int buff_len) {
 void Ack_receiver::run() {
   NET net;
   unsigned char net_buff[REPLY_MESSAGE_MAX_LENGTH];
+  char log_file_name[FN_REFLEN + 1];
+  my_off_t log_file_pos;
   uint i;
   Socket_listener listener;
 
@@ -308,16 +310,28 @@ void Ack_receiver::run() {
             (server_extension->compress_ctx.algorithm == MYSQL_ZLIB) ||
             (server_extension->compress_ctx.algorithm == MYSQL_ZSTD);
 
+        /*
+          A slave acknowledges positions in increasing order, so of all the
+          replies already buffered on its socket only the last one needs to
+          be reported. It releases every session the earlier ones would have,
+          while taking LOCK_binlog_ only once.
+        */
+        bool has_reply = false;
         do {
           net_clear(&net, false);
 
           len = my_net_read(&net);
-          if (likely(len != packet_error))
-            repl_semisync->reportReplyPacket(slave_obj.server_id, net.read_pos,
-                                             len);
-          else if (net.last_errno == ER_NET_READ_ERROR)
+          if (likely(len != packet_error)) {
+            if (likely(!ReplSemiSyncMaster::parseReplyPacket(
+                    net.read_pos, len, log_file_name, &log_file_pos)))
+              has_reply = true;
+          } else if (net.last_errno == ER_NET_READ_ERROR)
             listener.clear_socket_info(i);
         } while (net.vio->has_data(net.vio) && m_status == ST_UP);
+
+        if (has_reply)
+          repl_semisync->reportReply(slave_obj.server_id, log_file_name,
+                                     log_file_pos);
       }
       i++;
     }
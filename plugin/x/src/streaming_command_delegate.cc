@@ -31,6 +31,7 @@
 #include <memory>
 #include <string>
 #include <type_traits>
+#include <vector>
 
 #include "decimal.h"  // NOLINT(build/include_subdir)
 #include "my_dbug.h"  // NOLINT(build/include_subdir)
@@ -67,8 +68,8 @@ inline uint32_t get_valid_charset_collation(const CHARSET_INFO *resultset_cs,
 class Convert_if_necessary {
  public:
   Convert_if_necessary(const CHARSET_INFO *resultset_cs, const char *value,
-                       const size_t value_length,
-                       const CHARSET_INFO *value_cs) {
+                       const size_t value_length, const CHARSET_INFO *value_cs,
+                       std::vector<char> *buffer) {
     if (is_value_charset_valid(resultset_cs, value_cs)) {
       m_ptr = value;
       m_len = value_length;
@@ -76,16 +77,18 @@ class Convert_if_necessary {
     }
     size_t result_length =
         resultset_cs->mbmaxlen * value_length / value_cs->mbminlen;
-    m_buff.reset(new char[result_length]());
+    // The buffer is owned by the delegate and reused for every converted
+    // value, so it only grows to the widest value of the resultset.
+    if (buffer->size() < result_length) buffer->resize(result_length);
     uint32_t errors = 0;
-    result_length = my_convert(m_buff.get(), result_length, resultset_cs, value,
-                               value_length, value_cs, &errors);
+    result_length = my_convert(buffer->data(), result_length, resultset_cs,
+                               value, value_length, value_cs, &errors);
     if (errors) {
       log_debug("Error conversion data: %s(%s)", value, value_cs->csname);
       m_ptr = value;
       m_len = value_length;
     } else {
-      m_ptr = m_buff.get();
+      m_ptr = buffer->data();
       m_len = result_length;
     }
   }
@@ -95,7 +98,6 @@ class Convert_if_necessary {
  private:
   const char *m_ptr;
   size_t m_len;
-  std::unique_ptr<char[]> m_buff;
 };
 
 }  // namespace
@@ -466,7 +468,8 @@ int Streaming_command_delegate::get_string(const char *const value,
       m_proto->row_builder()->field_decimal(value, length);
       break;
     case MYSQL_TYPE_SET: {
-      Convert_if_necessary conv(m_resultcs, value, length, valuecs);
+      Convert_if_necessary conv(m_resultcs, value, length, valuecs,
+                                &m_convert_buffer);
       m_proto->row_builder()->field_set(conv.get_ptr(), conv.get_length());
       break;
     }
@@ -475,13 +478,15 @@ int Streaming_command_delegate::get_string(const char *const value,
       break;
     case MYSQL_TYPE_STRING:
       if (flags & SET_FLAG) {
-        Convert_if_necessary conv(m_resultcs, value, length, valuecs);
+        Convert_if_necessary conv(m_resultcs, value, length, valuecs,
+                                  &m_convert_buffer);
         m_proto->row_builder()->field_set(conv.get_ptr(), conv.get_length());
         break;
       }
       /* fall through */
     default: {
-      Convert_if_necessary conv(m_resultcs, value, length, valuecs);
+      Convert_if_necessary conv(m_resultcs, value, length, valuecs,
+                                &m_convert_buffer);
       m_proto->row_builder()->field_string(conv.get_ptr(), conv.get_length());
       break;
     }
@@ -109,6 +109,8 @@ class Streaming_command_delegate : public ngs::Command_delegate {
   bool m_send_notice_deferred = false;
   int m_filled_column_counter = 0;
   iface::Session *m_session;
+  /** Scratch space for values that need character set conversion. */
+  std::vector<char> m_convert_buffer;
 };
 
 }  // namespace xpl
@@ -237,7 +237,10 @@ void MySQLRoutingConnection::run() {
       }
 
       connection_is_ok = false;
-    } else {
+    } else if (copy_res.value() > 0) {
+      // copy_packets() returns 0 when this direction's socket wasn't
+      // readable, i.e. poll() returned for the other direction only. Don't
+      // touch the timestamp of the direction that didn't move data.
       last_received_from_server_ = std::chrono::system_clock::now();
       bytes_up_ += copy_res.value();
     }
@@ -262,7 +265,7 @@ void MySQLRoutingConnection::run() {
       }
       // client close on us.
       connection_is_ok = false;
-    } else {
+    } else if (copy_res.value() > 0) {
       last_sent_to_server_ = std::chrono::system_clock::now();
       bytes_down_ += copy_res.value();
     }
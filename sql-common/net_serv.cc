@@ -935,6 +935,20 @@ static bool net_write_buff(NET *net, const uchar *packet, size_t len) {
 #endif
   if (len > left_length) {
     if (net->write_pos != net->buff) {
+      if (!net->compress && len - left_length > net->max_packet) {
+        /*
+          The bulk of the packet would be written directly from the caller's
+          buffer anyway, so write out what is buffered and then the whole
+          packet, instead of first copying the head of it into the buffer.
+          This is the common case for large row events sent by the binlog
+          dump thread.
+        */
+        if (net_write_packet(net, net->buff,
+                             (size_t)(net->write_pos - net->buff)))
+          return true;
+        net->write_pos = net->buff;
+        return net_write_packet(net, packet, len);
+      }
       /* Fill up already used packet and write it */
       memcpy(net->write_pos, packet, left_length);
       if (net_write_packet(net, net->buff,
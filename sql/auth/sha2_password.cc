@@ -361,16 +361,21 @@ std::pair<bool, bool> Caching_sha2_password::fast_authenticate(
     return std::make_pair(true, false);
   }
 
-  rwlock_scoped_lock rdlock(&m_cache_lock, false, __FILE__, __LINE__);
   sha2_cache_entry digest;
 
-  if (m_cache.search(authorization_id, digest)) {
-    DBUG_PRINT("info", ("Could not find entry for %s in cache.",
-                        authorization_id.c_str()));
-    return std::make_pair(true, false);
+  {
+    rwlock_scoped_lock rdlock(&m_cache_lock, false, __FILE__, __LINE__);
+    if (m_cache.search(authorization_id, digest)) {
+      DBUG_PRINT("info", ("Could not find entry for %s in cache.",
+                          authorization_id.c_str()));
+      return std::make_pair(true, false);
+    }
   }
 
-  /* Entry found, so validate scramble against it */
+  /*
+    Entry found, so validate scramble against it. The entry has been copied,
+    so the cache lock does not need to be held while hashing.
+  */
   Validate_scramble validate_scramble_first(scramble, digest.digest_buffer[0],
                                             random, random_length);
   bool retval = validate_scramble_first.validate();
@@ -1418,6 +1418,17 @@ bool TemptableAggregateIterator::Init() {
       // nonfatal error.)
       restore_record(table(), record[1]);
       update_tmptable_sum_func(m_join->sum_funcs, table());
+      // Aggregates like MIN and MAX leave most groups unchanged for most
+      // rows. Without blobs the record image holds the whole row, so skip
+      // the handler round trip when nothing changed. Every engine counts
+      // an update before finding the row unchanged, so keep Handler_update
+      // the same as if the update had been done.
+      if (table()->s->blob_fields == 0 &&
+          memcmp(table()->record[0], table()->record[1],
+                 table()->s->reclength) == 0) {
+        thd()->status_var.ha_update_count++;
+        continue;
+      }
       int error =
           table()->file->ha_update_row(table()->record[1], table()->record[0]);
       if (error != 0 && error != HA_ERR_RECORD_IS_THE_SAME) {
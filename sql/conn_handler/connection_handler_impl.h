@@ -25,7 +25,7 @@
 #ifndef CONNECTION_HANDLER_IMPL_INCLUDED
 #define CONNECTION_HANDLER_IMPL_INCLUDED
 
-#include <list>
+#include <deque>
 
 #include "mysql/psi/mysql_cond.h"                 // mysql_cond_t
 #include "mysql/psi/mysql_mutex.h"                // mysql_mutex_t
@@ -56,7 +56,7 @@ class Per_thread_connection_handler : public Connection_handler {
     List of pending channel info objects to be picked by idle
     threads. Protected by LOCK_thread_cache.
   */
-  static std::list<Channel_info *> *waiting_channel_info_list;
+  static std::deque<Channel_info *> *waiting_channel_info_list;
 
   static mysql_mutex_t LOCK_thread_cache;
   static mysql_cond_t COND_thread_cache;
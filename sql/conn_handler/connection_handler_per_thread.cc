@@ -24,7 +24,7 @@
 
 #include <stddef.h>
 #include <sys/types.h>
-#include <list>
+#include <deque>
 #include <new>
 
 #include "my_compiler.h"
@@ -67,7 +67,7 @@ ulong Per_thread_connection_handler::blocked_pthread_count = 0;
 ulong Per_thread_connection_handler::slow_launch_threads = 0;
 ulong Per_thread_connection_handler::max_blocked_pthreads = 0;
 bool Per_thread_connection_handler::shrink_cache = false;
-std::list<Channel_info *>
+std::deque<Channel_info *>
     *Per_thread_connection_handler ::waiting_channel_info_list = nullptr;
 mysql_mutex_t Per_thread_connection_handler::LOCK_thread_cache;
 mysql_cond_t Per_thread_connection_handler::COND_thread_cache;
@@ -118,7 +118,7 @@ void Per_thread_connection_handler::init() {
                    MY_MUTEX_INIT_FAST);
   mysql_cond_init(key_COND_thread_cache, &COND_thread_cache);
   mysql_cond_init(key_COND_flush_thread_cache, &COND_flush_thread_cache);
-  waiting_channel_info_list = new (std::nothrow) std::list<Channel_info *>;
+  waiting_channel_info_list = new (std::nothrow) std::deque<Channel_info *>;
   DBUG_ASSERT(waiting_channel_info_list != nullptr);
 }
 
@@ -383,11 +383,17 @@ bool Per_thread_connection_handler::check_idle_thread_and_enqueue_connection(
     DBUG_PRINT("info", ("waiting_channel_info_list->push %p", channel_info));
     waiting_channel_info_list->push_back(channel_info);
     wake_pthread++;
-    mysql_cond_signal(&COND_thread_cache);
     res = false;
   }
   mysql_mutex_unlock(&LOCK_thread_cache);
 
+  /*
+    Signal after releasing the mutex, so the woken pthread does not
+    immediately block on LOCK_thread_cache held by the acceptor thread.
+    wake_pthread was updated under the mutex, so the wakeup cannot be lost.
+  */
+  if (!res) mysql_cond_signal(&COND_thread_cache);
+
   return res;
 }
 
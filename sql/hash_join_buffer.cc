@@ -22,6 +22,7 @@
 
 #include "sql/hash_join_buffer.h"
 
+#include <algorithm>
 #include <cstddef>
 #include <cstring>
 #include <iterator>
@@ -365,6 +366,20 @@ bool HashJoinRowBuffer::Init(std::uint32_t hash_seed) {
   return false;
 }
 
+void HashJoinRowBuffer::Reserve(size_t expected_rows) {
+  DBUG_ASSERT(Initialized());
+  DBUG_ASSERT(empty());
+
+  // Do not let the bucket array use more than a quarter of the memory that is
+  // available for the hash table. Each bucket is roughly the size of a
+  // pointer.
+  const size_t max_buckets = m_max_mem_available / (4 * sizeof(void *));
+  const size_t buckets = std::min(expected_rows, max_buckets);
+  if (buckets > m_hash_map->bucket_count()) {
+    m_hash_map->reserve(buckets);
+  }
+}
+
 StoreRowResult HashJoinRowBuffer::StoreRow(
     THD *thd, bool reject_duplicate_keys,
     bool store_rows_with_null_in_condition) {
@@ -600,6 +600,15 @@ bool HashJoinIterator::ReadNextHashJoinChunk() {
   HashJoinChunk &build_chunk =
       m_chunk_files_on_disk[m_current_chunk].build_chunk;
 
+  // We know exactly how many rows are in the build chunk, so size the hash
+  // table accordingly instead of letting it grow (and rehash) row by row. Only
+  // do this on the first pass over the chunk. If we get here again for the
+  // same chunk, the rows did not fit in memory, and a reservation for all the
+  // remaining rows would only take memory away from the rows we can store.
+  if (m_build_chunk_current_row == 0) {
+    m_row_buffer.Reserve(build_chunk.num_rows());
+  }
+
   const bool reject_duplicate_keys = RejectDuplicateKeys();
   const bool store_rows_with_null_in_join_key = m_join_type == JoinType::OUTER;
   for (; m_build_chunk_current_row < build_chunk.num_rows();
@@ -749,30 +749,47 @@ static bool fill_value_maps(
     table->file->ha_sample_end(scan_ctx); /* purecov: deadcode */
   });
 
+  /*
+    Resolve the Value_map and the value type of each column once, instead of
+    looking them up for every sampled row.
+  */
+  struct Sampled_column {
+    Field *field;
+    histograms::Value_map_base *value_map;
+    histograms::Value_map_type type;
+  };
+  std::vector<Sampled_column> columns;
+  columns.reserve(fields.size());
+  for (Field *field : fields)
+    columns.push_back({field, value_maps.at(field->field_index()).get(),
+                       histograms::field_type_to_value_map_type(field)});
+
   // Read the data from each column into its own Value_map.
   int res = table->file->ha_sample_next(scan_ctx, table->record[0]);
 
   while (res == 0) {
-    for (Field *field : fields) {
-      histograms::Value_map_base *value_map =
-          value_maps.at(field->field_index()).get();
+    for (const Sampled_column &column : columns) {
+      Field *field = column.field;
+      histograms::Value_map_base *value_map = column.value_map;
+
+      // No need to convert the value of a NULL column.
+      if (field->is_null()) {
+        value_map->add_null_values(1);
+        continue;
+      }
 
-      switch (histograms::field_type_to_value_map_type(field)) {
+      switch (column.type) {
         case histograms::Value_map_type::STRING: {
           StringBuffer<MAX_FIELD_WIDTH> str_buf(field->charset());
           field->val_str(&str_buf);
 
-          if (field->is_null())
-            value_map->add_null_values(1);
-          else if (value_map->add_values(static_cast<String>(str_buf), 1))
+          if (value_map->add_values(static_cast<String>(str_buf), 1))
             return true; /* purecov: deadcode */
           break;
         }
         case histograms::Value_map_type::DOUBLE: {
           double value = field->val_real();
-          if (field->is_null())
-            value_map->add_null_values(1);
-          else if (value_map->add_values(value, 1))
+          if (value_map->add_values(value, 1))
             return true; /* purecov: deadcode */
           break;
         }
@@ -780,17 +797,13 @@ static bool fill_value_maps(
         case histograms::Value_map_type::ENUM:
         case histograms::Value_map_type::SET: {
           longlong value = field->val_int();
-          if (field->is_null())
-            value_map->add_null_values(1);
-          else if (value_map->add_values(value, 1))
+          if (value_map->add_values(value, 1))
             return true; /* purecov: deadcode */
           break;
         }
         case histograms::Value_map_type::UINT: {
           ulonglong value = static_cast<ulonglong>(field->val_int());
-          if (field->is_null())
-            value_map->add_null_values(1);
-          else if (value_map->add_values(value, 1))
+          if (value_map->add_values(value, 1))
             return true; /* purecov: deadcode */
           break;
         }
@@ -798,9 +811,7 @@ static bool fill_value_maps(
           MYSQL_TIME time_value;
           TIME_from_longlong_date_packed(&time_value,
                                          field->val_date_temporal());
-          if (field->is_null())
-            value_map->add_null_values(1);
-          else if (value_map->add_values(time_value, 1))
+          if (value_map->add_values(time_value, 1))
             return true; /* purecov: deadcode */
           break;
         }
@@ -808,9 +819,7 @@ static bool fill_value_maps(
           MYSQL_TIME time_value;
           TIME_from_longlong_time_packed(&time_value,
                                          field->val_time_temporal());
-          if (field->is_null())
-            value_map->add_null_values(1);
-          else if (value_map->add_values(time_value, 1))
+          if (value_map->add_values(time_value, 1))
             return true; /* purecov: deadcode */
           break;
         }
@@ -818,9 +827,7 @@ static bool fill_value_maps(
           MYSQL_TIME time_value;
           TIME_from_longlong_datetime_packed(&time_value,
                                              field->val_date_temporal());
-          if (field->is_null())
-            value_map->add_null_values(1);
-          else if (value_map->add_values(time_value, 1))
+          if (value_map->add_values(time_value, 1))
             return true; /* purecov: deadcode */
           break;
         }
@@ -829,9 +836,7 @@ static bool fill_value_maps(
           my_decimal *value;
           value = field->val_decimal(&buffer);
 
-          if (field->is_null())
-            value_map->add_null_values(1);
-          else if (value_map->add_values(*value, 1))
+          if (value_map->add_values(*value, 1))
             return true; /* purecov: deadcode */
           break;
         }
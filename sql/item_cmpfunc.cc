@@ -1811,15 +1811,20 @@ int Arg_comparator::compare_real_fixed() {
   return -1;
 }
 
+/**
+  Compare values as BIGINT.
+
+  This is called once per row for integer predicates, and on unsorted input
+  the outcome of val1 < val2 is unpredictable, so the three-way result is
+  computed without branching on the values.
+*/
 int Arg_comparator::compare_int_signed() {
   longlong val1 = (*left)->val_int();
   if (!(*left)->null_value) {
     longlong val2 = (*right)->val_int();
     if (!(*right)->null_value) {
       if (set_null) owner->null_value = false;
-      if (val1 < val2) return -1;
-      if (val1 == val2) return 0;
-      return 1;
+      return (val1 > val2) - (val1 < val2);
     }
   }
   if (set_null) owner->null_value = true;
@@ -1854,7 +1859,7 @@ int Arg_comparator::compare_time_packed() {
     longlong val2 = (*right)->val_time_temporal();
     if (!(*right)->null_value) {
       if (set_null) owner->null_value = false;
-      return val1 < val2 ? -1 : val1 > val2 ? 1 : 0;
+      return (val1 > val2) - (val1 < val2);
     }
   }
   if (set_null) owner->null_value = true;
@@ -1871,9 +1876,7 @@ int Arg_comparator::compare_int_unsigned() {
     ulonglong val2 = (*right)->val_int();
     if (!(*right)->null_value) {
       if (set_null) owner->null_value = false;
-      if (val1 < val2) return -1;
-      if (val1 == val2) return 0;
-      return 1;
+      return (val1 > val2) - (val1 < val2);
     }
   }
   if (set_null) owner->null_value = true;
@@ -1007,6 +1007,7 @@ The documentation is based on the source files such as:
 #include <algorithm>
 #include <atomic>
 #include <functional>
+#include <list>
 #include <new>
 #include <string>
 #include <vector>
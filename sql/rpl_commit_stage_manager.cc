@@ -21,6 +21,7 @@
    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301  USA */
 
 #include <algorithm>
+#include <chrono>
 
 #include "sql/binlog.h"
 #include "sql/debug_sync.h"  // DEBUG_SYNC
@@ -375,8 +376,19 @@ void Commit_stage_manager::wait_count_or_timeout(ulong count, long usec,
 #ifndef DBUG_OFF
     if (current_thd) DEBUG_SYNC(current_thd, "bgc_wait_count_or_timeout");
 #endif
-    my_sleep(delta);
-    to_wait -= delta;
+    /*
+      Account for the time actually slept rather than the time asked for.
+      For small delays, a my_sleep() of a few microseconds typically lasts
+      tens of microseconds because of timer slack, so counting down by
+      delta would stretch the configured delay by an order of magnitude.
+    */
+    const auto start = std::chrono::steady_clock::now();
+    my_sleep(std::min(delta, to_wait));
+    const long slept = static_cast<long>(
+        std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - start)
+            .count());
+    to_wait -= std::max<long>(1, slept);
   }
 }
 
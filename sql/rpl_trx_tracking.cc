@@ -245,6 +245,13 @@ void Writeset_trx_dependency_tracker::get_dependency(THD *thd,
 
   mysql_mutex_lock(&LOCK_slave_trans_dep_tracker);
   if (can_use_writesets) {
+    /*
+     Size the buckets for a full history up front, so that filling it does
+     not rehash. This is a no-op unless the history size was changed.
+    */
+    if (m_writeset_history.empty())
+      m_writeset_history.reserve(m_opt_max_history_size);
+
     /*
      Check if adding this transaction exceeds the capacity of the writeset
      history. If that happens, m_writeset_history will be cleared only after
@@ -291,14 +298,15 @@ void Writeset_trx_dependency_tracker::get_dependency(THD *thd,
 
   if (exceeds_capacity || !can_use_writesets) {
     m_writeset_history_start = sequence_number;
-    m_writeset_history.clear();
+    /* clear() walks the whole bucket array, even on an empty map. */
+    if (!m_writeset_history.empty()) m_writeset_history.clear();
   }
   mysql_mutex_unlock(&LOCK_slave_trans_dep_tracker);
 }
 
 void Writeset_trx_dependency_tracker::rotate(int64 start) {
   m_writeset_history_start = start;
-  m_writeset_history.clear();
+  if (!m_writeset_history.empty()) m_writeset_history.clear();
 }
 
 /**
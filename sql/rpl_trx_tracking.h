@@ -25,7 +25,7 @@
 
 #include <sys/types.h>
 #include <atomic>
-#include <map>
+#include <unordered_map>
 
 #include "libbinlogevents/include/binlog_event.h"
 #include "my_dbug.h"
@@ -154,8 +154,11 @@ class Writeset_trx_dependency_tracker {
   /*
     Track the last transaction sequence number that changed each row
     in the database, using row hashes from the writeset as the index.
+    The keys are already hashes, so no ordering is needed and lookups are
+    constant time. The buckets are sized for m_opt_max_history_size and
+    kept when the history is cleared; each entry is still a node allocation.
   */
-  typedef std::map<uint64, int64> Writeset_history;
+  typedef std::unordered_map<uint64, int64> Writeset_history;
   Writeset_history m_writeset_history;
 };
 
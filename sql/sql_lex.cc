@@ -1353,7 +1353,7 @@ static int lex_one_token(Lexer_yystype *yylval, THD *thd) {
       case MY_LEX_IDENT:
         const char *start;
         if (use_mb(cs)) {
-          result_state = IDENT_QUOTED;
+          result_state = lip->yyGetLast();
           switch (my_mbcharlen(cs, lip->yyGetLast())) {
             case 1:
               break;
@@ -1370,6 +1370,9 @@ static int lex_one_token(Lexer_yystype *yylval, THD *thd) {
               lip->skip_binary(l - 1);
           }
           while (ident_map[c = lip->yyGet()]) {
+            result_state |= c;
+            /* ASCII is single-byte in every charset the parser accepts */
+            if (!(c & 0x80)) continue;
             switch (my_mbcharlen(cs, c)) {
               case 1:
                 break;
@@ -1384,6 +1387,11 @@ static int lex_one_token(Lexer_yystype *yylval, THD *thd) {
                 lip->skip_binary(l - 1);
             }
           }
+          /*
+            Plain ASCII identifiers need no validation or conversion to the
+            system charset, so only mark the token as quoted if needed.
+          */
+          result_state = result_state & 0x80 ? IDENT_QUOTED : IDENT;
         } else {
           for (result_state = c; ident_map[c = lip->yyGet()]; result_state |= c)
             ;
@@ -1516,8 +1524,11 @@ static int lex_one_token(Lexer_yystype *yylval, THD *thd) {
       case MY_LEX_IDENT_START:  // We come here after '.'
         result_state = IDENT;
         if (use_mb(cs)) {
-          result_state = IDENT_QUOTED;
+          result_state = 0;
           while (ident_map[c = lip->yyGet()]) {
+            result_state |= c;
+            /* ASCII is single-byte in every charset the parser accepts */
+            if (!(c & 0x80)) continue;
             switch (my_mbcharlen(cs, c)) {
               case 1:
                 break;
@@ -1532,6 +1543,11 @@ static int lex_one_token(Lexer_yystype *yylval, THD *thd) {
                 lip->skip_binary(l - 1);
             }
           }
+          /*
+            Plain ASCII identifiers need no validation or conversion to the
+            system charset, so only mark the token as quoted if needed.
+          */
+          result_state = result_state & 0x80 ? IDENT_QUOTED : IDENT;
         } else {
           for (result_state = 0; ident_map[c = lip->yyGet()]; result_state |= c)
             ;
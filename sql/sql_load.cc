@@ -1401,7 +1401,9 @@ READ_INFO::~READ_INFO() {
 }
 
 /**
-  The logic here is similar with my_mbcharlen, except for GET and PUSH
+  The logic here is similar with my_mbcharlen, except for GET and PUSH.
+  ASCII bytes are single characters in every charset with mbminlen == 1,
+  so they are handled without calling into the charset.
 
   @param[in]  cs  charset info
   @param[in]  chr the first char of sequence
@@ -1409,6 +1411,10 @@ READ_INFO::~READ_INFO() {
 */
 #define GET_MBCHARLEN(cs, chr, len)                     \
   do {                                                  \
+    if ((cs)->mbminlen == 1 && (uint)(chr) < 0x80) {    \
+      len = 1;                                          \
+      break;                                            \
+    }                                                   \
     len = my_mbcharlen((cs), (chr));                    \
     if (len == 0 && my_mbmaxlenlen((cs)) == 2) {        \
       int chr1 = GET;                                   \
@@ -692,6 +692,12 @@ int ha_tina::find_current_row(uchar *buf) {
 
   for (Field **field = table->field; *field; field++) {
     char curr_char;
+    /*
+      Columns that are not going to be stored only need to be skipped, so
+      none of their characters, escaped or not, are copied into the buffer.
+    */
+    const bool store_field =
+        read_all || bitmap_is_set(table->read_set, (*field)->field_index());
 
     buffer.length(0);
     if (curr_offset >= end_offset) goto err;
@@ -715,6 +721,7 @@ int ha_tina::find_current_row(uchar *buf) {
         if (curr_char == '\\' && curr_offset != (end_offset - 1)) {
           curr_offset++;
           curr_char = file_buff->get_value(curr_offset);
+          if (!store_field) continue;
           if (curr_char == 'r')
             buffer.append('\r');
           else if (curr_char == 'n')
@@ -733,7 +740,7 @@ int ha_tina::find_current_row(uchar *buf) {
             we are working with a damaged file.
           */
           if (curr_offset == end_offset - 1) goto err;
-          buffer.append(curr_char);
+          if (store_field) buffer.append(curr_char);
         }
       }
     } else {
@@ -747,6 +754,7 @@ int ha_tina::find_current_row(uchar *buf) {
         if (curr_char == '\\' && curr_offset != (end_offset - 1)) {
           curr_offset++;
           curr_char = file_buff->get_value(curr_offset);
+          if (!store_field) continue;
           if (curr_char == 'r')
             buffer.append('\r');
           else if (curr_char == 'n')
@@ -764,12 +772,12 @@ int ha_tina::find_current_row(uchar *buf) {
              unquoted field => We are working with a damaged field.
           */
           if (curr_offset == end_offset - 1 && curr_char == '"') goto err;
-          buffer.append(curr_char);
+          if (store_field) buffer.append(curr_char);
         }
       }
     }
 
-    if (read_all || bitmap_is_set(table->read_set, (*field)->field_index())) {
+    if (store_field) {
       bool is_enum = ((*field)->real_type() == MYSQL_TYPE_ENUM);
       /*
         Here CHECK_FIELD_WARN checks that all values in the csv file are valid
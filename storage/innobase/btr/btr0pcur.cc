@@ -34,7 +34,9 @@ this program; if not, write to the Free Software Foundation, Inc.,
 
 #include <stddef.h>
 
+#include "buf0rea.h"
 #include "rem0cmp.h"
+#include "srv0start.h"
 #include "trx0trx.h"
 #include "ut0byte.h"
 
@@ -279,6 +281,35 @@ bool btr_pcur_t::restore_position(ulint latch_mode, mtr_t *mtr,
   return (false);
 }
 
+/** Issue an asynchronous read for the right sibling of a leaf page that a
+forward scan has just moved to, unless the sibling is already in the buffer
+pool. Linear read-ahead only triggers when the pages of an extent are
+accessed in order, which is rarely the case for fragmented indexes. Reading
+the next leaf in the background overlaps its I/O with the processing of the
+current leaf, instead of stalling on it when the cursor gets there. A sibling
+that is the physically next page is left to linear read-ahead.
+@param[in]	block	leaf page the cursor has moved to */
+static void btr_pcur_prefetch_next_leaf(const buf_block_t *block) {
+  if (srv_startup_is_before_trx_rollback_phase) {
+    /* No read-ahead to avoid thread deadlocks */
+    return;
+  }
+
+  const auto next_page_no = fil_page_get_next(buf_block_get_frame(block));
+
+  if (next_page_no == FIL_NULL ||
+      next_page_no == block->page.id.page_no() + 1) {
+    return;
+  }
+
+  const page_id_t next_page_id(block->page.id.space(), next_page_no);
+
+  if (!buf_page_peek(next_page_id)) {
+    buf_read_page_background(next_page_id, block->page.size, false);
+    os_aio_simulated_wake_handler_threads();
+  }
+}
+
 void btr_pcur_t::move_to_next_page(mtr_t *mtr) {
   dict_table_t *table = get_btr_cur()->index->table;
 
@@ -336,6 +367,12 @@ void btr_pcur_t::move_to_next_page(mtr_t *mtr) {
 
   page_cur_set_before_first(next_block, get_page_cur());
 
+  /* Short range scans and LIMIT queries often stop on the next page;
+  only prefetch once the scan has crossed a couple of leaves. */
+  if (mode == BTR_SEARCH_LEAF && ++m_n_leaves_moved >= 2) {
+    btr_pcur_prefetch_next_leaf(next_block);
+  }
+
   ut_d(page_check_dir(next_page));
 }
 
@@ -450,6 +487,8 @@ void btr_pcur_t::open_on_user_rec(const page_cur_t &page_cursor,
 
   m_pos_state = BTR_PCUR_IS_POSITIONED;
 
+  m_n_leaves_moved = 0;
+
   m_latch_mode = BTR_LATCH_MODE_WITHOUT_FLAGS(latch_mode);
 
   m_trx_if_known = nullptr;
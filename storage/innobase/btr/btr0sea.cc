@@ -40,6 +40,7 @@ this program; if not, write to the Free Software Foundation, Inc.,
 #include "btr0sea.h"
 
 #include <sys/types.h>
+#include <algorithm>
 
 #include "btr0btr.h"
 #include "btr0cur.h"
@@ -1044,6 +1045,14 @@ ibool btr_search_guess_on_hash(dict_index_t *index, btr_search_t *info,
   return (TRUE);
 }
 
+/** Number of fold values that btr_search_drop_page_hash_index() can cache
+without allocating memory from the heap. It is sized for a default size
+page filled with records of 8 data bytes, e.g. a secondary index on an INT
+column of a table with an INT primary key, but bounded to 1024 entries to
+keep the stack frame small. */
+static constexpr ulint BTR_SEARCH_N_STACK_FOLDS =
+    std::min<ulint>(UNIV_PAGE_SIZE_DEF / (REC_N_NEW_EXTRA_BYTES + 8), 1024);
+
 /** Drop any adaptive hash index entries that point to an index page.
 @param[in,out]	block	block containing index page, s- or x-latched, or an
                         index page for which we know that
@@ -1063,9 +1072,11 @@ void btr_search_drop_page_hash_index(buf_block_t *block) {
   ulint i;
   mem_heap_t *heap;
   const dict_index_t *index;
+  ulint offsets_[REC_OFFS_NORMAL_SIZE];
   ulint *offsets;
   rw_lock_t *latch;
   btr_search_t *info;
+  ulint stack_folds[BTR_SEARCH_N_STACK_FOLDS];
 
 retry:
   /* Do a dirty check on block->index, return if the block is
@@ -1154,9 +1165,14 @@ retry:
   n_recs = page_get_n_recs(page);
 
   /* Calculate and cache fold values into an array for fast deletion
-  from the hash index */
+  from the hash index. Most pages have few enough records for the array
+  to fit on the stack, and the record offsets are computed into a stack
+  array too, which avoids heap allocations per dropped page when many
+  pages are freed at once, e.g. by a bulk DELETE. */
 
-  folds = (ulint *)ut_malloc_nokey(n_recs * sizeof(ulint));
+  folds = n_recs <= BTR_SEARCH_N_STACK_FOLDS
+              ? stack_folds
+              : static_cast<ulint *>(ut_malloc_nokey(n_recs * sizeof(ulint)));
 
   n_cached = 0;
 
@@ -1169,7 +1185,8 @@ retry:
   prev_fold = 0;
 
   heap = nullptr;
-  offsets = nullptr;
+  rec_offs_init(offsets_);
+  offsets = offsets_;
 
   while (!page_rec_is_supremum(rec)) {
     offsets = rec_get_offsets(
@@ -1210,7 +1227,9 @@ retry:
 
     rw_lock_x_unlock(latch);
 
-    ut_free(folds);
+    if (folds != stack_folds) {
+      ut_free(folds);
+    }
     goto retry;
   }
 
@@ -1232,7 +1251,9 @@ cleanup:
   assert_block_ahi_valid(block);
   rw_lock_x_unlock(latch);
 
-  ut_free(folds);
+  if (folds != stack_folds) {
+    ut_free(folds);
+  }
 }
 
 /** Drop any adaptive hash index entries that may point to an index
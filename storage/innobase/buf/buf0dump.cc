@@ -564,6 +564,8 @@ static void buf_load() {
 
   ib_time_monotonic_ms_t last_check_time = 0;
   ulint last_activity_cnt = 0;
+  /* Number of reads actually issued, used for throttling. */
+  ulint n_io = 0;
 
   /* Avoid calling the expensive fil_space_acquire_silent() for each
   page within the same tablespace. dump[] is sorted by (space, page),
@@ -602,8 +604,10 @@ static void buf_load() {
       continue;
     }
 
-    buf_read_page_background(page_id_t(this_space_id, BUF_DUMP_PAGE(dump[i])),
-                             page_size, true);
+    /* Pages that are already in the buffer pool, for example because
+    queries touched them while the load is running, do not cause any IO. */
+    const bool issued_io = buf_read_page_background(
+        page_id_t(this_space_id, BUF_DUMP_PAGE(dump[i])), page_size, true);
 
     if (i % 64 == 63) {
       os_aio_simulated_wake_handler_threads();
@@ -638,7 +642,9 @@ static void buf_load() {
       return;
     }
 
-    buf_load_throttle_if_needed(&last_check_time, &last_activity_cnt, i);
+    if (issued_io) {
+      buf_load_throttle_if_needed(&last_check_time, &last_activity_cnt, n_io++);
+    }
   }
 
   if (space != nullptr) {
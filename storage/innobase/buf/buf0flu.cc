@@ -2533,12 +2533,27 @@ ulint set_flush_target_by_lsn(bool sync_flush) {
 
   lsn_t target_lsn = oldest_lsn + lsn_avg_rate * buf_flush_lsn_scan_factor;
 
+  /* The estimate is capped at srv_max_io_capacity * 2 below, so there is no
+  point in counting more pages than that in any one instance. Bounding the
+  walk keeps the flush list mutex, which every mtr commit that dirties a
+  page needs, from being held for a scan of the whole list when the redo
+  generation rate is high.
+  This changes the flushing distribution: an instance that alone has more
+  old pages than the whole capped estimate is counted as exactly at the cap.
+  When pct_for_lsn > 30, the age weighted split below then gives all such
+  saturated instances equal shares, instead of shares proportional to their
+  true backlog. Likewise MONITOR_FLUSH_N_TO_FLUSH_BY_AGE saturates at
+  srv_buf_pool_instances * srv_max_io_capacity * 2. */
+  const ulint max_pages_to_scan =
+      srv_max_io_capacity * 2 * buf_flush_lsn_scan_factor;
+
   for (ulint i = 0; i < srv_buf_pool_instances; i++) {
     buf_pool_t *buf_pool = buf_pool_from_array(i);
     ulint pages_for_lsn = 0;
 
     buf_flush_list_mutex_enter(buf_pool);
-    for (buf_page_t *b = UT_LIST_GET_LAST(buf_pool->flush_list); b != nullptr;
+    for (buf_page_t *b = UT_LIST_GET_LAST(buf_pool->flush_list);
+         b != nullptr && pages_for_lsn < max_pages_to_scan;
          b = UT_LIST_GET_PREV(list, b)) {
       if (b->oldest_modification > target_lsn) {
         break;
@@ -1208,7 +1208,7 @@ int ha_innobase::parallel_scan_init(void *&scan_ctx, size_t &num_threads) {
   }
 
   scan_ctx = adapter;
-  num_threads = n_threads;
+  num_threads = adapter->release_surplus_threads();
 
   build_template(true);
 
@@ -9812,7 +9812,7 @@ int ha_innopart::parallel_scan_init(void *&scan_ctx, size_t &num_threads) {
   }
 
   scan_ctx = adapter;
-  num_threads = n_threads;
+  num_threads = adapter->release_surplus_threads();
 
   adapter->set(m_prebuilt);
 
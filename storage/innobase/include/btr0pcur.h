@@ -591,6 +591,10 @@ struct btr_pcur_t {
   /** Read level where the cursor would be positioned or re-positioned. */
   ulint m_read_level{0};
 
+  /** Number of leaf pages the cursor has moved forward to since it was
+  last positioned by a search. Used to prefetch only for longer scans. */
+  ulint m_n_leaves_moved{0};
+
   /* NOTE that the following field is initialized only during import
   tablespace, otherwise undefined */
   import_ctx_t *import_ctx{nullptr};
@@ -651,6 +655,8 @@ inline void btr_pcur_t::open(dict_index_t *index, ulint level,
 
   m_pos_state = BTR_PCUR_IS_POSITIONED;
 
+  m_n_leaves_moved = 0;
+
   m_trx_if_known = nullptr;
 }
 
@@ -675,6 +681,8 @@ inline void btr_pcur_t::open_at_side(bool from_left, dict_index_t *index,
 
   m_pos_state = BTR_PCUR_IS_POSITIONED;
 
+  m_n_leaves_moved = 0;
+
   m_old_stored = false;
 
   m_trx_if_known = nullptr;
@@ -697,6 +705,8 @@ inline bool btr_pcur_t::set_random_position(dict_index_t *index,
 
   m_pos_state = BTR_PCUR_IS_POSITIONED;
 
+  m_n_leaves_moved = 0;
+
   return (positioned);
 }
 
@@ -725,6 +735,8 @@ inline void btr_pcur_t::open_no_init(dict_index_t *index, const dtuple_t *tuple,
 
   m_pos_state = BTR_PCUR_IS_POSITIONED;
 
+  m_n_leaves_moved = 0;
+
   m_old_stored = false;
 
   m_trx_if_known = nullptr;
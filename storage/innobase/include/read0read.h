@@ -35,6 +35,7 @@ this program; if not, write to the Free Software Foundation, Inc.,
 
 #include <stddef.h>
 #include <algorithm>
+#include <atomic>
 
 #include "read0types.h"
 #include "univ.i"
@@ -126,6 +127,11 @@ class MVCC {
   /** Active and closed views, the closed views will have the
   creator trx id set to TRX_ID_MAX */
   view_list_t m_views;
+
+  /** Size of trx_sys->rw_trx_ids seen by the last view_open(). It is
+  written while holding trx_sys->mutex and read without it, as a hint
+  for sizing a reused view before the mutex is acquired. */
+  std::atomic<ulint> m_n_rw_trx_ids_hint{0};
 };
 
 #endif /* read0read_h */
@@ -297,11 +297,14 @@ void row_merge_file_destroy(
     merge_file_t *merge_file); /*!< in/out: merge file structure */
 /** Read a merge block from the file system.
  @return true if request was successful, false if fail */
-ibool row_merge_read(int fd,                  /*!< in: file descriptor */
-                     ulint offset,            /*!< in: offset where to read
-                                              in number of row_merge_block_t
-                                              elements */
-                     row_merge_block_t *buf); /*!< out: data */
+ibool row_merge_read(int fd,                 /*!< in: file descriptor */
+                     ulint offset,           /*!< in: offset where to read
+                                             in number of row_merge_block_t
+                                             elements */
+                     row_merge_block_t *buf, /*!< out: data */
+                     ulint read_ahead_end = 0); /*!< in: offset just past
+                                             the end of the run being read,
+                                             or 0 to not read ahead */
 /** Read a merge record.
  @return pointer to next record, or NULL on I/O error or end of list */
 const byte *row_merge_read_rec(
@@ -314,6 +317,8 @@ const byte *row_merge_read_rec(
     const mrec_t **mrec,       /*!< out: pointer to merge record,
                                or NULL on end of list
                                (non-NULL on I/O error) */
-    ulint *offsets)            /*!< out: offsets of mrec */
+    ulint *offsets,            /*!< out: offsets of mrec */
+    ulint foffs_end = 0)       /*!< in: file offset just past the
+                               end of the run, or 0 to not read ahead */
     MY_ATTRIBUTE((warn_unused_result));
 #endif /* row0merge.h */
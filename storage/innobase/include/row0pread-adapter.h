@@ -69,6 +69,13 @@ class Parallel_reader_adapter {
   dberr_t add_scan(trx_t *trx, const Parallel_reader::Config &config,
                    Parallel_reader::F &&f) MY_ATTRIBUTE((warn_unused_result));
 
+  /** Release the threads that the added scans cannot use.
+  @see Parallel_reader::release_surplus_threads()
+  @return the number of threads that run() will spawn. */
+  size_t release_surplus_threads() {
+    return (m_parallel_reader.release_surplus_threads());
+  }
+
   /** Run the parallel scan.
   @param[in]  thread_contexts   Context for each of the spawned threads
   @param[in]  init_fn           Callback called by each parallel load thread
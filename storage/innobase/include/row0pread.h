@@ -295,6 +295,14 @@ class Parallel_reader {
   dberr_t add_scan(trx_t *trx, const Config &config, F &&f)
       MY_ATTRIBUTE((warn_unused_result));
 
+  /** Release the threads that the queued execution contexts cannot use.
+  If none of the contexts will be split any further then the number of work
+  items is fixed, and threads beyond that number would only wake up and
+  exit. Call after the last add_scan(), so that max_threads() reports the
+  number of threads that run() will spawn.
+  @return the number of threads that run() will spawn. */
+  size_t release_surplus_threads();
+
   /** Wait for the join of threads spawned by the parallel reader. */
   void join() {
     for (auto &t : m_parallel_read_threads) {
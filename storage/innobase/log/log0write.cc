@@ -1442,20 +1442,31 @@ static inline void prepare_full_blocks(const log_t &log, byte *buffer,
   in the log buffer (incomplete blocks will be rewritten once they
   became completed). */
 
-  size_t buffer_offset;
+  if (size < OS_FILE_LOG_BLOCK_SIZE) {
+    return;
+  }
 
-  for (buffer_offset = 0; buffer_offset + OS_FILE_LOG_BLOCK_SIZE <= size;
-       buffer_offset += OS_FILE_LOG_BLOCK_SIZE) {
-    byte *ptr;
+  const size_t full_size =
+      static_cast<size_t>(ut_uint64_align_down(size, OS_FILE_LOG_BLOCK_SIZE));
 
-    ptr = buffer + buffer_offset;
+  ut_a(buffer >= log.buf);
+  ut_a(buffer + full_size <= log.buf + log.buf_size);
 
-    ut_a(ptr >= log.buf);
+  /* This loop runs for every block written by the log writer, so keep the
+  work which is the same for all blocks of the batch out of it. The block
+  numbers are consecutive (modulo LOG_BLOCK_MAX_NO), and a change of
+  innodb_log_checksums does not need to take effect within a batch. */
+  const auto checksum_func = log_checksum_algorithm_ptr.load();
 
-    ut_a(ptr + OS_FILE_LOG_BLOCK_SIZE <= log.buf + log.buf_size);
+  uint32_t block_no = log_block_convert_lsn_to_no(start_lsn);
 
-    log_block_set_hdr_no(
-        ptr, log_block_convert_lsn_to_no(start_lsn + buffer_offset));
+  for (size_t buffer_offset = 0; buffer_offset < full_size;
+       buffer_offset += OS_FILE_LOG_BLOCK_SIZE) {
+    byte *ptr = buffer + buffer_offset;
+
+    ut_ad(block_no == log_block_convert_lsn_to_no(start_lsn + buffer_offset));
+
+    log_block_set_hdr_no(ptr, block_no);
 
     log_block_set_flush_bit(ptr, buffer_offset == 0);
 
@@ -1463,7 +1474,9 @@ static inline void prepare_full_blocks(const log_t &log, byte *buffer,
 
     log_block_set_checkpoint_no(ptr, checkpoint_no);
 
-    log_block_store_checksum(ptr);
+    log_block_set_checksum(ptr, checksum_func(ptr));
+
+    block_no = block_no == LOG_BLOCK_MAX_NO ? 1 : block_no + 1;
   }
 }
 
@@ -154,6 +154,18 @@ skip:
                              << errno;
     ptr = nullptr;
   } else {
+#if defined UNIV_LINUX && defined MADV_HUGEPAGE
+    /* With --large-pages, this is the fallback after the hugetlb
+    allocation above failed: let transparent huge pages back the
+    region instead when THP is in "madvise" mode. Without
+    --large-pages the region is left alone, so that THP with its
+    khugepaged stalls and RSS growth stays opt-in. This is only a
+    hint: it fails harmlessly when THP is disabled, so the result is
+    ignored. */
+    if (os_use_large_pages) {
+      madvise(ptr, size, MADV_HUGEPAGE);
+    }
+#endif /* UNIV_LINUX && MADV_HUGEPAGE */
     os_atomic_increment_ulint(&os_total_large_mem_allocated, size);
     UNIV_MEM_ALLOC(ptr, size);
   }
@@ -368,6 +368,9 @@ void ReadView::copy_trx_ids(const trx_ids_t &trx_ids) {
     return;
   }
 
+  /* No need to copy the old contents across during reserve(). */
+  m_ids.clear();
+
   m_ids.reserve(size);
   m_ids.resize(size);
 
@@ -541,6 +544,16 @@ void MVCC::view_open(ReadView *&view, trx_t *trx) {
       }
     }
 
+    /* Make room for the active transaction ids before acquiring the
+    trx_sys_t::mutex, so that prepare() does not have to allocate memory
+    while holding it. The hint may be stale, in which case prepare() will
+    reserve the remainder. The view is closed and owned only by this
+    trx until it is re-added to m_views under the mutex below, and
+    purge skips closed views. */
+    view->m_ids.clear();
+    view->m_ids.reserve(
+        m_n_rw_trx_ids_hint.load(std::memory_order_relaxed) + 1);
+
     mutex_enter(&trx_sys->mutex);
 
     UT_LIST_REMOVE(m_views, view);
@@ -554,6 +567,9 @@ void MVCC::view_open(ReadView *&view, trx_t *trx) {
   if (view != nullptr) {
     view->prepare(trx->id);
 
+    m_n_rw_trx_ids_hint.store(trx_sys->rw_trx_ids.size(),
+                              std::memory_order_relaxed);
+
     UT_LIST_ADD_FIRST(m_views, view);
 
     ut_ad(!view->is_closed());
@@ -273,6 +273,7 @@ void index_tuple_info_t::cache_tuples() {
 @param[in]	index		index to be inserted
 @param[in]	old_table	old table
 @param[in]	fd		file descriptor
+@param[in]	foffs_end	number of blocks in the file, or 0
 @param[in,out]	block		file buffer
 @param[in]	row_buf		row_buf the sorted data tuples,
 or NULL if fd, block will be used instead
@@ -283,8 +284,8 @@ and then stage->inc() will be called for each record that is processed.
 @return DB_SUCCESS or error number */
 static MY_ATTRIBUTE((warn_unused_result)) dberr_t row_merge_insert_index_tuples(
     trx_t *trx, dict_index_t *index, const dict_table_t *old_table, int fd,
-    row_merge_block_t *block, const row_merge_buf_t *row_buf, BtrBulk *btr_bulk,
-    ut_stage_alter_t *stage = nullptr);
+    ulint foffs_end, row_merge_block_t *block, const row_merge_buf_t *row_buf,
+    BtrBulk *btr_bulk, ut_stage_alter_t *stage = nullptr);
 
 /** Encode an index record. */
 static void row_merge_buf_encode(
@@ -1072,7 +1073,10 @@ ibool row_merge_read(int fd,                 /*!< in: file descriptor */
                      ulint offset,           /*!< in: offset where to read
                                              in number of row_merge_block_t
                                              elements */
-                     row_merge_block_t *buf) /*!< out: data */
+                     row_merge_block_t *buf, /*!< out: data */
+                     ulint read_ahead_end)   /*!< in: offset just past
+                                             the end of the run being read,
+                                             or 0 to not read ahead */
 {
   os_offset_t ofs = ((os_offset_t)offset) * srv_sort_buf_size;
   dberr_t err;
@@ -1096,9 +1100,21 @@ ibool row_merge_read(int fd,                 /*!< in: file descriptor */
 
   if (err != DB_SUCCESS) {
     ib::error(ER_IB_MSG_965) << "Failed to read merge block at " << ofs;
+    return FALSE;
   }
 
-  return err == DB_SUCCESS;
+#ifdef POSIX_FADV_WILLNEED
+  /* Runs are read sequentially, both when merging and when inserting
+  the sorted tuples. Let the kernel start reading the next block of
+  this run while the current one is being processed. Not done when the
+  file cache is disabled, or on the last block of the run. */
+  if (!srv_disable_sort_file_cache && offset + 1 < read_ahead_end) {
+    posix_fadvise(fd, ofs + srv_sort_buf_size, srv_sort_buf_size,
+                  POSIX_FADV_WILLNEED);
+  }
+#endif /* POSIX_FADV_WILLNEED */
+
+  return TRUE;
 }
 
 /** Write a merge block to the file system.
@@ -1143,7 +1159,9 @@ const byte *row_merge_read_rec(
     const mrec_t **mrec,       /*!< out: pointer to merge record,
                                or NULL on end of list
                                (non-NULL on I/O error) */
-    ulint *offsets)            /*!< out: offsets of mrec */
+    ulint *offsets,            /*!< out: offsets of mrec */
+    ulint foffs_end)           /*!< in: file offset just past the
+                               end of the run, or 0 to not read ahead */
 {
   ulint extra_size;
   ulint data_size;
@@ -1177,7 +1195,7 @@ const byte *row_merge_read_rec(
     /* Read another byte of extra_size. */
 
     if (UNIV_UNLIKELY(b >= &block[srv_sort_buf_size])) {
-      if (!row_merge_read(fd, ++(*foffs), block)) {
+      if (!row_merge_read(fd, ++(*foffs), block, foffs_end)) {
       err_exit:
         /* Signal I/O error. */
         *mrec = b;
@@ -1206,7 +1224,7 @@ const byte *row_merge_read_rec(
     ut_ad(avail_size < sizeof *buf);
     memcpy(*buf, b, avail_size);
 
-    if (!row_merge_read(fd, ++(*foffs), block)) {
+    if (!row_merge_read(fd, ++(*foffs), block, foffs_end)) {
       goto err_exit;
     }
 
@@ -1265,7 +1283,7 @@ const byte *row_merge_read_rec(
   ut_d(offsets[2] = (ulint)*mrec);
   ut_d(offsets[3] = (ulint)index);
 
-  if (!row_merge_read(fd, ++(*foffs), block)) {
+  if (!row_merge_read(fd, ++(*foffs), block, foffs_end)) {
     goto err_exit;
   }
 
@@ -2224,7 +2242,7 @@ static MY_ATTRIBUTE((warn_unused_result)) dberr_t
             clust_btr_bulk->latch();
           }
 
-          err = row_merge_insert_index_tuples(trx, index[i], old_table, -1,
+          err = row_merge_insert_index_tuples(trx, index[i], old_table, -1, 0,
                                               nullptr, buf, clust_btr_bulk);
 
           if (row == nullptr) {
@@ -2315,7 +2333,7 @@ static MY_ATTRIBUTE((warn_unused_result)) dberr_t
           err = btr_bulk.init();
           if (err == DB_SUCCESS) {
             err = row_merge_insert_index_tuples(trx, index[i], old_table, -1,
-                                                nullptr, buf, &btr_bulk);
+                                                0, nullptr, buf, &btr_bulk);
 
             err = btr_bulk.finish(err);
           }
@@ -2545,7 +2563,8 @@ all_done:
     }                                                                        \
     b##N =                                                                   \
         row_merge_read_rec(&block[N * srv_sort_buf_size], &buf[N], b##N,     \
-                           INDEX, file->fd, foffs##N, &mrec##N, offsets##N); \
+                           INDEX, file->fd, foffs##N, &mrec##N, offsets##N,  \
+                           end##N);                                          \
     if (UNIV_UNLIKELY(!b##N)) {                                              \
       if (mrec##N) {                                                         \
         goto corrupt;                                                        \
@@ -2573,6 +2592,8 @@ all_done:
 @param[in,out]	block	3 buffers
 @param[in,out]	foffs0	offset of first source list in the file
 @param[in,out]	foffs1	offset of second source list in the file
+@param[in]	end0	offset just past the end of the first source list
+@param[in]	end1	offset just past the end of the second source list
 @param[in,out]	of	output file
 @param[in,out]	stage	performance schema accounting object, used by
 ALTER TABLE. If not NULL stage->inc() will be called for each record
@@ -2581,7 +2602,8 @@ processed.
 static MY_ATTRIBUTE((warn_unused_result)) dberr_t
     row_merge_blocks(const row_merge_dup_t *dup, const merge_file_t *file,
                      row_merge_block_t *block, ulint *foffs0, ulint *foffs1,
-                     merge_file_t *of, ut_stage_alter_t *stage) {
+                     ulint end0, ulint end1, merge_file_t *of,
+                     ut_stage_alter_t *stage) {
   mem_heap_t *heap; /*!< memory heap for offsets0, offsets1 */
 
   mrec_buf_t *buf;     /*!< buffer for handling
@@ -2605,8 +2627,8 @@ static MY_ATTRIBUTE((warn_unused_result)) dberr_t
   /* Write a record and read the next record.  Split the output
   file in two halves, which can be merged on the following pass. */
 
-  if (!row_merge_read(file->fd, *foffs0, &block[0]) ||
-      !row_merge_read(file->fd, *foffs1, &block[srv_sort_buf_size])) {
+  if (!row_merge_read(file->fd, *foffs0, &block[0], end0) ||
+      !row_merge_read(file->fd, *foffs1, &block[srv_sort_buf_size], end1)) {
   corrupt:
     mem_heap_free(heap);
     return DB_CORRUPTION;
@@ -2617,9 +2639,10 @@ static MY_ATTRIBUTE((warn_unused_result)) dberr_t
   b2 = &block[2 * srv_sort_buf_size];
 
   b0 = row_merge_read_rec(&block[0], &buf[0], b0, dup->index, file->fd, foffs0,
-                          &mrec0, offsets0);
+                          &mrec0, offsets0, end0);
   b1 = row_merge_read_rec(&block[srv_sort_buf_size], &buf[srv_sort_buf_size],
-                          b1, dup->index, file->fd, foffs1, &mrec1, offsets1);
+                          b1, dup->index, file->fd, foffs1, &mrec1, offsets1,
+                          end1);
   if (UNIV_UNLIKELY(!b0 && mrec0) || UNIV_UNLIKELY(!b1 && mrec1)) {
     goto corrupt;
   }
@@ -2664,6 +2687,7 @@ done1:
 @param[in]	file	input file
 @param[in,out]	block	3 buffers
 @param[in,out]	foffs0	input file offset
+@param[in]	end0	offset just past the end of the input list
 @param[in,out]	of	output file
 @param[in,out]	stage	performance schema accounting object, used by
 ALTER TABLE. If not NULL stage->inc() will be called for each record
@@ -2671,7 +2695,7 @@ processed.
 @return true on success, false on failure */
 static MY_ATTRIBUTE((warn_unused_result)) ibool
     row_merge_blocks_copy(const dict_index_t *index, const merge_file_t *file,
-                          row_merge_block_t *block, ulint *foffs0,
+                          row_merge_block_t *block, ulint *foffs0, ulint end0,
                           merge_file_t *of, ut_stage_alter_t *stage) {
   mem_heap_t *heap; /*!< memory heap for offsets0, offsets1 */
 
@@ -2692,7 +2716,7 @@ static MY_ATTRIBUTE((warn_unused_result)) ibool
   /* Write a record and read the next record.  Split the output
   file in two halves, which can be merged on the following pass. */
 
-  if (!row_merge_read(file->fd, *foffs0, &block[0])) {
+  if (!row_merge_read(file->fd, *foffs0, &block[0], end0)) {
   corrupt:
     mem_heap_free(heap);
     return FALSE;
@@ -2703,7 +2727,7 @@ static MY_ATTRIBUTE((warn_unused_result)) ibool
   b2 = &block[2 * srv_sort_buf_size];
 
   b0 = row_merge_read_rec(&block[0], &buf[0], b0, index, file->fd, foffs0,
-                          &mrec0, offsets0);
+                          &mrec0, offsets0, end0);
   if (UNIV_UNLIKELY(!b0 && mrec0)) {
     goto corrupt;
   }
@@ -2750,6 +2774,20 @@ static dberr_t row_merge(trx_t *trx, const row_merge_dup_t *dup,
   /*!< half the input file */
   ulint n_run = 0;
   /*!< num of runs generated from this merge */
+  const ulint n_in_run = *num_run;
+  /*!< num of runs in the input file */
+  ulint run0 = 0;
+  /*!< input run being read from the first half */
+  ulint run1 = n_in_run / 2;
+  /*!< input run being read from the second half */
+
+  /* Offset just past the end of input run r, used to stop reading ahead
+  at the end of each run. Every output run consumes at least one input
+  run, so run_offset[r + 1] has not been overwritten yet when this is
+  called for the input run r. */
+  const auto run_end = [&](ulint r) {
+    return (r + 1 < n_in_run ? run_offset[r + 1] : file->offset);
+  };
 
   UNIV_MEM_ASSERT_W(&block[0], 3 * srv_sort_buf_size);
 
@@ -2770,17 +2808,19 @@ static dberr_t row_merge(trx_t *trx, const row_merge_dup_t *dup,
   foffs0 = 0;
   foffs1 = ihalf;
 
-  UNIV_MEM_INVALID(run_offset, *num_run * sizeof *run_offset);
-
   for (; foffs0 < ihalf && foffs1 < file->offset; foffs0++, foffs1++) {
     if (trx_is_interrupted(trx)) {
       return (DB_INTERRUPTED);
     }
 
+    const ulint end0 = run_end(run0++);
+    const ulint end1 = run_end(run1++);
+
     /* Remember the offset number for this run */
     run_offset[n_run++] = of.offset;
 
-    error = row_merge_blocks(dup, file, block, &foffs0, &foffs1, &of, stage);
+    error = row_merge_blocks(dup, file, block, &foffs0, &foffs1, end0, end1,
+                             &of, stage);
 
     if (error != DB_SUCCESS) {
       return (error);
@@ -2794,10 +2834,13 @@ static dberr_t row_merge(trx_t *trx, const row_merge_dup_t *dup,
       return (DB_INTERRUPTED);
     }
 
+    const ulint end0 = run_end(run0++);
+
     /* Remember the offset number for this run */
     run_offset[n_run++] = of.offset;
 
-    if (!row_merge_blocks_copy(dup->index, file, block, &foffs0, &of, stage)) {
+    if (!row_merge_blocks_copy(dup->index, file, block, &foffs0, end0, &of,
+                               stage)) {
       return (DB_CORRUPTION);
     }
   }
@@ -2809,10 +2852,13 @@ static dberr_t row_merge(trx_t *trx, const row_merge_dup_t *dup,
       return (DB_INTERRUPTED);
     }
 
+    const ulint end1 = run_end(run1++);
+
     /* Remember the offset number for this run */
     run_offset[n_run++] = of.offset;
 
-    if (!row_merge_blocks_copy(dup->index, file, block, &foffs1, &of, stage)) {
+    if (!row_merge_blocks_copy(dup->index, file, block, &foffs1, end1, &of,
+                               stage)) {
       return (DB_CORRUPTION);
     }
   }
@@ -2859,7 +2905,6 @@ and then stage->inc() will be called for each record processed.
 dberr_t row_merge_sort(trx_t *trx, const row_merge_dup_t *dup,
                        merge_file_t *file, row_merge_block_t *block, int *tmpfd,
                        ut_stage_alter_t *stage /* = NULL */) {
-  const ulint half = file->offset / 2;
   ulint num_runs;
   ulint *run_offset;
   dberr_t error = DB_SUCCESS;
@@ -2880,9 +2925,12 @@ dberr_t row_merge_sort(trx_t *trx, const row_merge_dup_t *dup,
   /* "run_offset" records each run's first offset number */
   run_offset = (ulint *)ut_malloc_nokey(file->offset * sizeof(ulint));
 
-  /* This tells row_merge() where to start for the first round
-  of merge. */
-  run_offset[half] = half;
+  /* Before the first round of merge, every block is a run of its own.
+  row_merge() uses run_offset[] to find the start of the second half and
+  the end of each run. */
+  for (ulint i = 0; i < file->offset; ++i) {
+    run_offset[i] = i;
+  }
 
   /* The file should always contain at least one byte (the end
   of file marker).  Thus, it must be at least one block. */
@@ -3005,6 +3053,7 @@ static void row_merge_mtuple_to_dtuple(dict_index_t *index, dtuple_t *dtuple,
 @param[in]	index		index to be inserted
 @param[in]	old_table	old table
 @param[in]	fd		file descriptor
+@param[in]	foffs_end	number of blocks in the file, or 0
 @param[in,out]	block		file buffer
 @param[in]	row_buf		row_buf the sorted data tuples,
 or NULL if fd, block will be used instead
@@ -3015,8 +3064,8 @@ and then stage->inc() will be called for each record that is processed.
 @return DB_SUCCESS or error number */
 static MY_ATTRIBUTE((warn_unused_result)) dberr_t row_merge_insert_index_tuples(
     trx_t *trx, dict_index_t *index, const dict_table_t *old_table, int fd,
-    row_merge_block_t *block, const row_merge_buf_t *row_buf, BtrBulk *btr_bulk,
-    ut_stage_alter_t *stage /* = NULL */) {
+    ulint foffs_end, row_merge_block_t *block, const row_merge_buf_t *row_buf,
+    BtrBulk *btr_bulk, ut_stage_alter_t *stage /* = NULL */) {
   const byte *b;
   mem_heap_t *heap;
   mem_heap_t *tuple_heap;
@@ -3060,7 +3109,8 @@ static MY_ATTRIBUTE((warn_unused_result)) dberr_t row_merge_insert_index_tuples(
     b = block;
     dtuple = nullptr;
 
-    if (!row_merge_read(fd, foffs, block)) {
+    /* After sorting, the file holds a single run. */
+    if (!row_merge_read(fd, foffs, block, foffs_end)) {
       error = DB_CORRUPTION;
       goto err_exit;
     } else {
@@ -3089,7 +3139,8 @@ static MY_ATTRIBUTE((warn_unused_result)) dberr_t row_merge_insert_index_tuples(
       /* BLOB pointers must be copied from dtuple */
       mrec = nullptr;
     } else {
-      b = row_merge_read_rec(block, buf, b, index, fd, &foffs, &mrec, offsets);
+      b = row_merge_read_rec(block, buf, b, index, fd, &foffs, &mrec, offsets,
+                             foffs_end);
       if (UNIV_UNLIKELY(!b)) {
         /* End of list, or I/O error */
         if (mrec) {
@@ -3839,9 +3890,9 @@ dberr_t row_merge_build_indexes(
         BtrBulk btr_bulk(sort_idx, trx->id, flush_observer);
         error = btr_bulk.init();
         if (error == DB_SUCCESS) {
-          error = row_merge_insert_index_tuples(trx, sort_idx, old_table,
-                                                merge_files[i].fd, block,
-                                                nullptr, &btr_bulk, stage);
+          error = row_merge_insert_index_tuples(
+              trx, sort_idx, old_table, merge_files[i].fd,
+              merge_files[i].offset, block, nullptr, &btr_bulk, stage);
 
           error = btr_bulk.finish(error);
         }
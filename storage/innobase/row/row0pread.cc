@@ -29,6 +29,7 @@ Parallel read implementation
 
 Created 2018-01-27 by Sunny Bains */
 
+#include <algorithm>
 #include <array>
 
 #include "btr0pcur.h"
@@ -1189,8 +1190,29 @@ void Parallel_reader::parallel_read() {
   join();
 }
 
+size_t Parallel_reader::release_surplus_threads() {
+  mutex_enter(&m_mutex);
+
+  const auto n_ctxs = m_ctxs.size();
+
+  const auto will_split = std::any_of(
+      m_ctxs.begin(), m_ctxs.end(),
+      [](const std::shared_ptr<Ctx> &ctx) { return (ctx->m_split); });
+
+  mutex_exit(&m_mutex);
+
+  if (!will_split && n_ctxs > 0 && n_ctxs < m_max_threads) {
+    release_unused_threads(m_max_threads - n_ctxs);
+  }
+
+  return (m_max_threads);
+}
+
 dberr_t Parallel_reader::run() {
   if (!m_scan_ctxs.empty()) {
+    /* A no-op if the caller has already released the surplus threads. */
+    release_surplus_threads();
+
     parallel_read();
   }
 
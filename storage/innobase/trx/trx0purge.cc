@@ -31,7 +31,9 @@ this program; if not, write to the Free Software Foundation, Inc.,
  *******************************************************/
 
 #include <sys/types.h>
+#include <algorithm>
 #include <new>
+#include <vector>
 
 #include "clone0api.h"
 #include "clone0clone.h"
@@ -2141,25 +2143,46 @@ static ulint trx_purge_attach_undo_recs(const ulint n_purge_threads,
   batch are handled by the same thread. Ths is to avoid contention
   on the dict_index_t::lock */
 
-  GroupBy::const_iterator end = group_by.cend();
+  /* Hand out the tables largest first, each to the thread with the fewest
+  records so far. Dealing them round robin in table id order could give one
+  thread several big tables while the others go idle early, and the batch
+  only completes when the last thread is done. */
+  std::vector<GroupBy::const_iterator> groups;
+  groups.reserve(group_by.size());
 
-  for (GroupBy::const_iterator it = group_by.cbegin(); it != end;) {
-    for (ulint i = 0; i < n_purge_threads && it != end; ++i, ++it) {
-      purge_node_t *node;
+  for (auto it = group_by.cbegin(); it != group_by.cend(); ++it) {
+    groups.push_back(it);
+  }
 
-      node = static_cast<purge_node_t *>(run_thrs[i]->child);
+  std::stable_sort(
+      groups.begin(), groups.end(),
+      [](GroupBy::const_iterator lhs, GroupBy::const_iterator rhs) {
+        return (lhs->second->size() > rhs->second->size());
+      });
 
-      ut_a(que_node_get_type(node) == QUE_NODE_PURGE);
+  ulint n_recs_assigned[MAX_PURGE_THREADS] = {};
 
-      if (node->recs == nullptr) {
-        node->recs = it->second;
-      } else {
-        for (auto iter = it->second->begin(); iter != it->second->end();
-             ++iter) {
-          node->recs->push_back(*iter);
-        }
+  for (auto it : groups) {
+    const ulint least_loaded =
+        std::min_element(n_recs_assigned, n_recs_assigned + n_purge_threads) -
+        n_recs_assigned;
+
+    purge_node_t *node;
+
+    node = static_cast<purge_node_t *>(run_thrs[least_loaded]->child);
+
+    ut_a(que_node_get_type(node) == QUE_NODE_PURGE);
+
+    if (node->recs == nullptr) {
+      node->recs = it->second;
+    } else {
+      for (auto iter = it->second->begin(); iter != it->second->end();
+           ++iter) {
+        node->recs->push_back(*iter);
       }
     }
+
+    n_recs_assigned[least_loaded] += it->second->size();
   }
 
 #ifdef UNIV_DEBUG
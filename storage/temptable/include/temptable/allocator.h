@@ -140,7 +140,19 @@ struct Exponential {
   guide's recommendation to have clear ownership of objects, but at least it
   avoids the use-after-free.
  */
-struct AllocatorState {
+struct AllocatorState : private MemoryMonitor {
+  /** Destructor. Releases the current block if it was kept alive after all
+   * of its chunks were freed. */
+  ~AllocatorState() {
+    if (!current_block.is_empty() &&
+        current_block.number_of_used_chunks() == 0) {
+      if (current_block.type() == Source::RAM) {
+        MemoryMonitor::ram_decrease(current_block.size());
+      }
+      current_block.destroy();
+    }
+  }
+
   /** Current not-yet-full block to feed allocations from. */
   Block current_block;
 
@@ -180,7 +192,9 @@ struct AllocatorState {
  * Allocator does not store a list of all allocated blocks but only keeps track
  * of the current block which has not yet been entirely filled up and the
  * overall number of allocated blocks. When current block gets filled up, new
- * one is created and immediately made current.
+ * one is created and immediately made current. The current block is not
+ * released when all of its chunks are freed, so that a table which is emptied
+ * and refilled does not go back to the OS for memory each time.
  *
  * Furthermore, it always keeps the last block alive. It cannot be deallocated
  * by the user. Last block is automatically deallocated at the thread exit.
@@ -358,6 +372,16 @@ inline T *Allocator<T, AllocationScheme>::allocate(size_t n_elements) {
     block = m_shared_block;
   } else if (m_state->current_block.is_empty() ||
              !m_state->current_block.can_accommodate(n_bytes_requested)) {
+    if (!m_state->current_block.is_empty() &&
+        m_state->current_block.number_of_used_chunks() == 0) {
+      // The current block was kept alive empty but is too small for this
+      // request, release it before it gets replaced.
+      if (m_state->current_block.type() == Source::RAM) {
+        MemoryMonitor::ram_decrease(m_state->current_block.size());
+      }
+      m_state->current_block.destroy();
+      --m_state->number_of_blocks;
+    }
     const size_t block_size = AllocationScheme::block_size(
         m_state->number_of_blocks, n_bytes_requested);
     const Source block_source = [block_size]() {
@@ -404,16 +428,16 @@ inline void Allocator<T, AllocationScheme>::deallocate(T *chunk_data,
   if (remaining_chunks == 0) {
     if (m_shared_block && (block == *m_shared_block)) {
       // Do nothing. Keep the last block alive.
+    } else if (block == m_state->current_block) {
+      // Do nothing. The block is empty again and will feed the next
+      // allocations, e.g. when the table is truncated and refilled. It is
+      // released together with the allocator state.
     } else {
       DBUG_ASSERT(m_state->number_of_blocks > 0);
       if (block.type() == Source::RAM) {
         MemoryMonitor::ram_decrease(block.size());
       }
-      if (block == m_state->current_block) {
-        m_state->current_block.destroy();
-      } else {
-        block.destroy();
-      }
+      block.destroy();
       --m_state->number_of_blocks;
     }
   }
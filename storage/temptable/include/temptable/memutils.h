@@ -204,9 +204,20 @@ inline void *Memory<Source::MMAP_FILE>::fetch(size_t bytes) {
     return nullptr;
   }
 
-  /* This will write `bytes` 0xa bytes to the file on disk. */
-  if (my_fallocator(f, bytes, 0xa, MYF(MY_WME)) != 0 ||
-      my_seek(f, 0, MY_SEEK_SET, MYF(MY_WME)) == MY_FILEPOS_ERROR) {
+  /* Reserve the disk space up front so that writes through the mapping can
+  not fail later. Where the filesystem supports it, posix_fallocate() does
+  that without writing the blocks, which avoids streaming `bytes` of filler
+  to disk before the block can be used. */
+#ifdef HAVE_POSIX_FALLOCATE
+  const bool reserved = posix_fallocate(f, 0, bytes) == 0;
+#else
+  const bool reserved = false;
+#endif /* HAVE_POSIX_FALLOCATE */
+
+  /* Otherwise this will write `bytes` 0xa bytes to the file on disk. */
+  if (!reserved &&
+      (my_fallocator(f, bytes, 0xa, MYF(MY_WME)) != 0 ||
+       my_seek(f, 0, MY_SEEK_SET, MYF(MY_WME)) == MY_FILEPOS_ERROR)) {
     my_close(f, MYF(MY_WME));
     return nullptr;
   }
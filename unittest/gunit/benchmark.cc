@@ -37,6 +37,7 @@ static bool timer_running = false;
 static double seconds_used;
 static steady_clock::time_point timer_start;
 static size_t bytes_processed = 0;
+static size_t items_processed = 0;
 
 void StartBenchmarkTiming() {
   assert(!timer_running);
@@ -54,6 +55,8 @@ void StopBenchmarkTiming() {
 
 void SetBytesProcessed(size_t bytes) { bytes_processed = bytes; }
 
+void SetItemsProcessed(size_t items) { items_processed = items; }
+
 void internal_do_microbenchmark(const char *name, void (*func)(size_t)) {
 #if !defined(DBUG_OFF)
   printf(
@@ -94,5 +97,14 @@ void internal_do_microbenchmark(const char *name, void (*func)(size_t)) {
     bytes_processed = 0;  // Reset for next test.
   }
 
+  if (items_processed > 0) {
+    double items_per_second = items_processed / seconds_used;
+    if (items_per_second > 1e6)
+      printf(" %8.2f M items/sec", items_per_second / 1e6);
+    else
+      printf(" %8.2f k items/sec", items_per_second / 1e3);
+    items_processed = 0;  // Reset for next test.
+  }
+
   printf("\n");
 }
@@ -46,5 +46,6 @@ void internal_do_microbenchmark(const char *name, void (*func)(size_t));
 void StartBenchmarkTiming();
 void StopBenchmarkTiming();
 void SetBytesProcessed(size_t num_bytes);
+void SetItemsProcessed(size_t num_items);
 
 #endif  // BENCHMARK_H_INCLUDED
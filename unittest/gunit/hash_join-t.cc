@@ -482,6 +482,7 @@ static void BM_HashTableIteratorBuild(size_t num_iterations) {
     ASSERT_FALSE(hash_join_iterator.Init());
   }
   StopBenchmarkTiming();
+  SetItemsProcessed(num_iterations * left_dataset.size());
 
   initializer.TearDown();
 }
@@ -243,4 +243,35 @@ TEST(Allocator, Casts) {
   EXPECT_NO_THROW(allocator1.deallocate(items1[1], 1));
 }
 
+TEST(Allocator, ReuseEmptiedCurrentBlock) {
+  Allocator_helper::set_allocator_max_ram_default();
+  init_allocator_once();
+
+  temptable::Block shared_block;
+  temptable::Allocator<char> allocator(&shared_block);
+
+  /* Occupy the shared block so that bigger requests go to a block owned by
+   * the allocator itself. */
+  char *small = nullptr;
+  EXPECT_NO_THROW(small = allocator.allocate(1));
+
+  const size_t big = 2 * 1024 * 1024;
+  char *first = nullptr;
+  EXPECT_NO_THROW(first = allocator.allocate(big));
+  EXPECT_NO_THROW(allocator.deallocate(first, big));
+
+  /* The emptied block is kept and feeds the next allocation. */
+  char *second = nullptr;
+  EXPECT_NO_THROW(second = allocator.allocate(big));
+  EXPECT_EQ(first, second);
+
+  /* A request that does not fit replaces the emptied block. */
+  EXPECT_NO_THROW(allocator.deallocate(second, big));
+  char *bigger = nullptr;
+  EXPECT_NO_THROW(bigger = allocator.allocate(4 * big));
+  EXPECT_NO_THROW(allocator.deallocate(bigger, 4 * big));
+
+  EXPECT_NO_THROW(allocator.deallocate(small, 1));
+}
+
 }  // namespace temptable_test